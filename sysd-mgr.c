@@ -5,6 +5,33 @@
 #include <string.h>
 #include <unistd.h>
 #include <fcntl.h>
+#include <dirent.h>
+#include <errno.h>
+#include <sys/stat.h>
+#include <sys/inotify.h>
+#include <glib-unix.h>
+
+/* files larger than this are not unit files; don't read them into the pane or the index */
+#define UNIT_FILE_MAX_SIZE (1024 * 1024)
+
+/* read_unit_file() flags */
+#define READ_FILE_NOFOLLOW 0x1             /* fail on a symlink instead of reading its target */
+
+/* in-memory copy of every unit file under the search roots, kept current via inotify */
+typedef struct {
+    GMutex lock;                           /* guards files, watches and pending */
+    GHashTable *files;                     /* path -> NUL-terminated contents */
+    GHashTable *watches;                   /* inotify wd -> directory path */
+    GThreadPool *pool;                     /* non-NULL only while a parallel build is running */
+    gint pending;                          /* directories queued or being walked */
+    gboolean building;                     /* build running on the pool; files must not be read */
+    GList *waiters;                        /* callers to hand to built_cb once the build finishes */
+    GFunc built_cb;                        /* run on the main loop for each waiter */
+    int inotify_fd;
+    guint inotify_source;
+    gboolean watch_failed;                 /* some directory is not watched -> contents may go stale */
+    gboolean valid;                        /* FALSE until built, after an inotify queue overflow or a failed watch */
+} UnitIndex;
 
 typedef struct {
     GtkStatusbar *statusbar;
@@ -13,6 +40,8 @@ typedef struct {
     GtkWidget *filter_entry;               /* common filter entry */
     GtkNotebook *notebook;                 /* notebook pointer - used to know active page */
     GtkTreeView *views[3];                 /* treeviews for selection handling */
+    GtkTextBuffer *unit_buffer;            /* unit-file pane: FragmentPath + DropInPaths of selection */
+    UnitIndex *unit_index;                 /* cross-unit content search, built on first search */
 } AppData;
 
 /* forward declarations (ensure functions used before definition are known) */
@@ -39,6 +68,20 @@ static void get_unit_property_value(const char *unit, const char *prop, char *ou
     pclose(fp);
 }
 
+/* like get_unit_property_value, but returns the whole value however long it is
+   (newly allocated, caller must g_free; "" on failure) */
+static gchar *get_unit_property_full(const char *unit, const char *prop) {
+    if (!unit || !prop) return g_strdup("");
+    gchar *argv[] = { "systemctl", "show", "-p", (gchar *)prop, "--value", (gchar *)unit, NULL };
+    gchar *out = NULL;
+    if (!g_spawn_sync(NULL, argv, NULL, G_SPAWN_SEARCH_PATH | G_SPAWN_STDERR_TO_DEV_NULL,
+                      NULL, NULL, &out, NULL, NULL, NULL) || !out) {
+        g_free(out);
+        return g_strdup("");
+    }
+    return g_strstrip(out);
+}
+
 /* Parse a "list-units" line:
    example:
      ssh.service loaded active running OpenSSH Daemon
@@ -153,6 +196,314 @@ static void populate_store_parsed(GtkListStore *store, const char *cmd, int mode
     pclose(fp);
 }
 
+/* read a whole file into a newly allocated NUL-terminated buffer (caller must g_free).
+   Returns NULL if path is not a readable regular file. Plain read(): a file truncated by
+   another writer while we read it just comes back short. */
+static gchar *read_unit_file(const char *path, int flags, gsize *out_len) {
+    if (out_len) *out_len = 0;
+    if (!path) return NULL;
+    int fd = open(path, O_RDONLY | O_CLOEXEC | O_NONBLOCK |
+                        ((flags & READ_FILE_NOFOLLOW) ? O_NOFOLLOW : 0));
+    if (fd < 0) return NULL;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size > UNIT_FILE_MAX_SIZE) {
+        close(fd);
+        return NULL;
+    }
+    gsize len = (gsize)st.st_size;
+    gchar *data = g_malloc(len + 1);
+    gsize got = 0;
+    while (got < len) {
+        ssize_t r = read(fd, data + got, len - got);
+        if (r < 0 && errno == EINTR) continue;
+        if (r <= 0) break;
+        got += (gsize)r;
+    }
+    len = got; /* file may have shrunk since fstat */
+    close(fd);
+    data[len] = '\0';
+    if (out_len) *out_len = len;
+    return data;
+}
+
+/* directories scanned by the unit file content search */
+static const char *unit_search_roots[] = {
+    "/etc/systemd/system",
+    "/usr/lib/systemd/system",
+    "/run/systemd",
+    NULL
+};
+
+static UnitIndex *unit_index_new(GFunc built_cb) {
+    UnitIndex *idx = g_new0(UnitIndex, 1);
+    g_mutex_init(&idx->lock);
+    idx->built_cb = built_cb;
+    idx->files = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, g_free);
+    idx->watches = g_hash_table_new_full(g_direct_hash, g_direct_equal, NULL, g_free);
+    idx->inotify_fd = -1;
+    return idx;
+}
+
+/* (re)read one file into the index, or drop it if it is gone / no longer a regular file.
+   Symlinks are never indexed (see unit_index_walk_dir), whether found by the walk or by inotify. */
+static void unit_index_load_file(UnitIndex *idx, const char *path) {
+    gchar *data = read_unit_file(path, READ_FILE_NOFOLLOW, NULL);
+    g_mutex_lock(&idx->lock);
+    if (data) {
+        g_hash_table_replace(idx->files, g_strdup(path), data);
+    } else {
+        g_hash_table_remove(idx->files, path);
+    }
+    g_mutex_unlock(&idx->lock);
+}
+
+static void unit_index_add_watch(UnitIndex *idx, const char *dir) {
+    if (idx->inotify_fd < 0) return;
+    int wd = inotify_add_watch(idx->inotify_fd, dir,
+                               IN_CREATE | IN_CLOSE_WRITE | IN_DELETE |
+                               IN_MOVED_FROM | IN_MOVED_TO | IN_ONLYDIR);
+    g_mutex_lock(&idx->lock);
+    if (wd >= 0) {
+        g_hash_table_replace(idx->watches, GINT_TO_POINTER(wd), g_strdup(dir));
+    } else {
+        /* e.g. ENOSPC: this directory can go stale, so rebuild on the next search */
+        idx->watch_failed = TRUE;
+        idx->valid = FALSE;
+    }
+    g_mutex_unlock(&idx->lock);
+}
+
+static void unit_index_walk_dir(UnitIndex *idx, const char *dir);
+static gboolean unit_index_build_finish(gpointer user_data);
+
+/* queue a directory on the build pool; pending is decremented by the worker when done */
+static void unit_index_schedule_dir(UnitIndex *idx, const char *dir) {
+    g_mutex_lock(&idx->lock);
+    idx->pending++;
+    g_mutex_unlock(&idx->lock);
+    g_thread_pool_push(idx->pool, g_strdup(dir), NULL);
+}
+
+static void unit_index_worker(gpointer data, gpointer user_data) {
+    UnitIndex *idx = (UnitIndex *)user_data;
+    gchar *dir = (gchar *)data;
+    unit_index_walk_dir(idx, dir);
+    g_free(dir);
+
+    g_mutex_lock(&idx->lock);
+    if (--idx->pending == 0) g_idle_add(unit_index_build_finish, idx);
+    g_mutex_unlock(&idx->lock);
+}
+
+/* index every regular file below dir and watch each directory.
+   Symlinks are skipped: *.wants links and aliases point at files indexed in their own directory.
+   While a parallel build runs, subdirectories go to the pool; otherwise recurse in place. */
+static void unit_index_walk_dir(UnitIndex *idx, const char *dir) {
+    DIR *d = opendir(dir);
+    if (!d) return;
+    unit_index_add_watch(idx, dir);
+
+    struct dirent *de;
+    while ((de = readdir(d)) != NULL) {
+        if (strcmp(de->d_name, ".") == 0 || strcmp(de->d_name, "..") == 0) continue;
+
+        unsigned char type = de->d_type;
+        if (type == DT_UNKNOWN) {
+            struct stat st;
+            if (fstatat(dirfd(d), de->d_name, &st, AT_SYMLINK_NOFOLLOW) != 0) continue;
+            if (S_ISDIR(st.st_mode)) type = DT_DIR;
+            else if (S_ISREG(st.st_mode)) type = DT_REG;
+        }
+
+        gchar *full = g_build_filename(dir, de->d_name, NULL);
+        if (type == DT_DIR) {
+            if (idx->pool) unit_index_schedule_dir(idx, full);
+            else unit_index_walk_dir(idx, full);
+        } else if (type == DT_REG) {
+            unit_index_load_file(idx, full);
+        }
+        g_free(full);
+    }
+    closedir(d);
+}
+
+static gboolean unit_index_has_prefix(gpointer key, gpointer value, gpointer user_data) {
+    (void)value;
+    return g_str_has_prefix((const gchar *)key, (const gchar *)user_data);
+}
+
+/* forget a directory that was deleted or moved away: drop its files and the watches on it and
+   its subdirectories, so later events inside it are not indexed under stale paths.
+   Caller holds idx->lock. */
+static void unit_index_drop_dir(UnitIndex *idx, const char *dir) {
+    gchar *prefix = g_strconcat(dir, "/", NULL);
+    g_hash_table_foreach_remove(idx->files, unit_index_has_prefix, prefix);
+
+    GHashTableIter it;
+    gpointer wd, path;
+    g_hash_table_iter_init(&it, idx->watches);
+    while (g_hash_table_iter_next(&it, &wd, &path)) {
+        if (strcmp((const gchar *)path, dir) == 0 || g_str_has_prefix((const gchar *)path, prefix)) {
+            inotify_rm_watch(idx->inotify_fd, GPOINTER_TO_INT(wd));
+            g_hash_table_iter_remove(&it);
+        }
+    }
+    g_free(prefix);
+}
+
+/* drain inotify events and apply them to the index (runs on the main loop) */
+static gboolean on_unit_index_inotify(gint fd, GIOCondition cond, gpointer user_data) {
+    (void)cond;
+    UnitIndex *idx = (UnitIndex *)user_data;
+    char buf[8192] __attribute__((aligned(__alignof__(struct inotify_event))));
+    ssize_t len;
+
+    while ((len = read(fd, buf, sizeof(buf))) > 0) {
+        char *p = buf;
+        while (p < buf + len) {
+            const struct inotify_event *ev = (const struct inotify_event *)p;
+            p += sizeof(struct inotify_event) + ev->len;
+
+            if (ev->mask & IN_Q_OVERFLOW) {
+                /* events were lost: rebuild from scratch on the next search */
+                idx->valid = FALSE;
+                continue;
+            }
+
+            g_mutex_lock(&idx->lock);
+            if (ev->mask & IN_IGNORED) {
+                g_hash_table_remove(idx->watches, GINT_TO_POINTER(ev->wd));
+                g_mutex_unlock(&idx->lock);
+                continue;
+            }
+            const gchar *dir = g_hash_table_lookup(idx->watches, GINT_TO_POINTER(ev->wd));
+            gchar *path = (dir && ev->len > 0) ? g_build_filename(dir, ev->name, NULL) : NULL;
+            g_mutex_unlock(&idx->lock);
+            if (!path) continue;
+
+            if (ev->mask & (IN_DELETE | IN_MOVED_FROM)) {
+                g_mutex_lock(&idx->lock);
+                if (ev->mask & IN_ISDIR) {
+                    unit_index_drop_dir(idx, path);
+                } else {
+                    g_hash_table_remove(idx->files, path);
+                }
+                g_mutex_unlock(&idx->lock);
+            } else if (ev->mask & IN_ISDIR) {
+                /* directory created or moved in: pick up its contents and watch it */
+                unit_index_walk_dir(idx, path);
+            } else {
+                unit_index_load_file(idx, path);
+            }
+            g_free(path);
+        }
+    }
+    return G_SOURCE_CONTINUE;
+}
+
+/* (re)build the index in the background: walk all search roots in parallel on a thread pool and
+   set up fresh inotify watches. unit_index_build_finish() completes it on the main loop. */
+static void unit_index_build_start(UnitIndex *idx) {
+    if (idx->building) return;
+    idx->building = TRUE;
+    if (idx->inotify_source) {
+        g_source_remove(idx->inotify_source);
+        idx->inotify_source = 0;
+    }
+    if (idx->inotify_fd >= 0) close(idx->inotify_fd);
+    idx->inotify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+
+    g_mutex_lock(&idx->lock);
+    g_hash_table_remove_all(idx->files);
+    g_hash_table_remove_all(idx->watches);
+    idx->watch_failed = (idx->inotify_fd < 0);
+    /* hold one count while queueing the roots so a fast worker can't finish the build early */
+    idx->pending = 1;
+    g_mutex_unlock(&idx->lock);
+
+    idx->pool = g_thread_pool_new(unit_index_worker, idx, (gint)g_get_num_processors(), FALSE, NULL);
+    for (int i = 0; unit_search_roots[i]; ++i) {
+        if (g_file_test(unit_search_roots[i], G_FILE_TEST_IS_DIR)) {
+            unit_index_schedule_dir(idx, unit_search_roots[i]);
+        }
+    }
+
+    g_mutex_lock(&idx->lock);
+    if (--idx->pending == 0) g_idle_add(unit_index_build_finish, idx);
+    g_mutex_unlock(&idx->lock);
+}
+
+/* every queued directory has been walked: start processing inotify events and notify waiters */
+static gboolean unit_index_build_finish(gpointer user_data) {
+    UnitIndex *idx = (UnitIndex *)user_data;
+    /* at most the last worker is still returning from unit_index_worker() */
+    g_thread_pool_free(idx->pool, FALSE, TRUE);
+    idx->pool = NULL;
+
+    if (idx->inotify_fd >= 0) {
+        idx->inotify_source = g_unix_fd_add(idx->inotify_fd, G_IO_IN, on_unit_index_inotify, idx);
+    }
+    /* without complete watches the contents can go stale, so rebuild on every search instead */
+    idx->valid = !idx->watch_failed;
+    idx->building = FALSE;
+
+    GList *waiters = idx->waiters;
+    idx->waiters = NULL;
+    for (GList *l = waiters; l; l = l->next) idx->built_cb(l->data, idx);
+    g_list_free(waiters);
+    return G_SOURCE_REMOVE;
+}
+
+/* make sure waiter is passed to built_cb when the running build finishes */
+static void unit_index_add_waiter(UnitIndex *idx, gpointer waiter) {
+    if (!g_list_find(idx->waiters, waiter)) idx->waiters = g_list_append(idx->waiters, waiter);
+}
+
+/* append lines containing needle to store (3 cols: path,line,text), at most max_rows of them.
+   Paths and lines are made valid UTF-8 for display; /run/systemd also holds non-unit state files.
+   Returns the number of matching lines (including ones past max_rows); out_files gets the
+   number of files with a match. */
+static guint unit_index_search(UnitIndex *idx, const char *needle, GtkListStore *store,
+                               guint max_rows, guint *out_files) {
+    guint matches = 0, files = 0;
+    if (out_files) *out_files = 0;
+    if (!idx || !needle || needle[0] == '\0') return 0;
+
+    GList *paths = g_list_sort(g_hash_table_get_keys(idx->files), (GCompareFunc)strcmp);
+    for (GList *l = paths; l; l = l->next) {
+        const gchar *path = (const gchar *)l->data;
+        const gchar *data = g_hash_table_lookup(idx->files, path);
+        if (!data || !strstr(data, needle)) continue;
+        files++;
+        gchar *display = g_filename_display_name(path);
+
+        guint lineno = 1;
+        const gchar *line = data;
+        while (*line) {
+            const gchar *eol = strchr(line, '\n');
+            gsize n = eol ? (gsize)(eol - line) : strlen(line);
+            if (g_strstr_len(line, n, needle) && matches++ < max_rows) {
+                gchar *text = g_utf8_make_valid(line, n);
+                GtkTreeIter iter;
+                gtk_list_store_insert_with_values(store, &iter, -1,
+                                                  0, display,
+                                                  1, lineno,
+                                                  2, g_strstrip(text),
+                                                  -1);
+                g_free(text);
+            }
+            if (!eol) break;
+            line = eol + 1;
+            lineno++;
+        }
+        g_free(display);
+    }
+    g_list_free(paths);
+    if (out_files) *out_files = files;
+    return matches;
+}
+
 /* Filter helper data */
 typedef struct {
     AppData *ad;
@@ -268,9 +619,11 @@ static gchar *prompt_for_password(GtkWindow *parent) {
 }
 
 /* run a command via pkexec (preferred). Returns TRUE on success, FALSE otherwise.
-   If provided, out_stderr will be set to newly allocated string with stderr (caller must g_free). */
-static gboolean run_command_pkexec_and_collect(const char *cmd, gchar **out_stderr) {
+   If provided, out_stderr will be set to newly allocated string with stderr (caller must g_free).
+   out_unavailable is set when pkexec could not start or authorize (exit 126/127), i.e. cmd never ran. */
+static gboolean run_command_pkexec_and_collect(const char *cmd, gchar **out_stderr, gboolean *out_unavailable) {
     if (out_stderr) *out_stderr = NULL;
+    if (out_unavailable) *out_unavailable = FALSE;
     gchar *full = g_strdup_printf("pkexec /bin/sh -c '%s 2>&1 1>/dev/null'", cmd);
     gchar *out = NULL;
     gchar *err = NULL;
@@ -284,8 +637,13 @@ static gboolean run_command_pkexec_and_collect(const char *cmd, gchar **out_stde
         }
         g_clear_error(&gerr);
         g_free(out); g_free(err);
+        if (out_unavailable) *out_unavailable = TRUE;
         return FALSE;
     }
+    if (out_unavailable && WIFEXITED(status) &&
+        (WEXITSTATUS(status) == 126 || WEXITSTATUS(status) == 127)) {
+        *out_unavailable = TRUE;
+    }
     /* err contains combined output due to our redirect; use it */
     if (out_stderr && err) *out_stderr = g_strdup(err);
     g_free(out); g_free(err);
@@ -356,9 +714,13 @@ static gboolean run_command_with_sudo_and_password(const char *cmd, gchar **stde
 static void run_systemctl_action_and_notify(AppData *ad, const char *cmd) {
     if (!ad) return;
     gchar *err = NULL;
-    gboolean ok = run_command_pkexec_and_collect(cmd, &err);
-    if (!ok) {
-        /* fallback to sudo with password prompt */
+    gboolean unavailable = FALSE;
+    gboolean ok = run_command_pkexec_and_collect(cmd, &err, &unavailable);
+    if (!ok && unavailable) {
+        /* fallback to sudo with password prompt, only if pkexec never ran the command:
+           re-running a command that ran and failed would repeat its side effects */
+        g_free(err);
+        err = NULL;
         gboolean ok2 = run_command_with_sudo_and_password(cmd, &err, GTK_WINDOW(gtk_widget_get_toplevel(GTK_WIDGET(ad->statusbar))));
         if (ok2) ok = TRUE;
     }
@@ -459,6 +821,349 @@ static void on_toggle_enable_toggled(GtkToggleButton *tb, gpointer user_data) {
     g_free(cmd); g_free(unit);
 }
 
+/* append unit file text to buf, tagging [Section] headers, Key= names and comments */
+static void append_unit_text_highlighted(GtkTextBuffer *buf, const char *text) {
+    GtkTextIter end;
+    const char *line = text;
+    while (*line) {
+        const char *eol = strchr(line, '\n');
+        gsize n = eol ? (gsize)(eol - line + 1) : strlen(line);
+        const char *p = line;
+        while (p < line + n && (*p == ' ' || *p == '\t')) p++;
+
+        gtk_text_buffer_get_end_iter(buf, &end);
+        if (*p == '#' || *p == ';') {
+            gtk_text_buffer_insert_with_tags_by_name(buf, &end, line, n, "comment", NULL);
+        } else if (*p == '[') {
+            gtk_text_buffer_insert_with_tags_by_name(buf, &end, line, n, "section", NULL);
+        } else {
+            const char *eq = memchr(line, '=', n);
+            if (eq) {
+                gtk_text_buffer_insert_with_tags_by_name(buf, &end, line, eq - line, "key", NULL);
+                gtk_text_buffer_get_end_iter(buf, &end);
+                gtk_text_buffer_insert(buf, &end, eq, n - (eq - line));
+            } else {
+                gtk_text_buffer_insert(buf, &end, line, n);
+            }
+        }
+        if (!eol) break;
+        line = eol + 1;
+    }
+}
+
+static void append_unit_file(GtkTextBuffer *buf, const char *path) {
+    GtkTextIter end;
+    gtk_text_buffer_get_end_iter(buf, &end);
+    gchar *display = g_filename_display_name(path);
+    gchar *hdr = g_strdup_printf("# %s\n", display);
+    g_free(display);
+    gtk_text_buffer_insert_with_tags_by_name(buf, &end, hdr, -1, "header", NULL);
+    g_free(hdr);
+
+    gsize len = 0;
+    gchar *data = read_unit_file(path, 0, &len);
+    if (data) {
+        /* GtkTextBuffer only accepts UTF-8; a Latin-1 Description= would otherwise blank the pane */
+        gchar *text = g_utf8_make_valid(data, len);
+        append_unit_text_highlighted(buf, text);
+        g_free(text);
+        if (len > 0 && data[len-1] != '\n') {
+            gtk_text_buffer_get_end_iter(buf, &end);
+            gtk_text_buffer_insert(buf, &end, "\n", -1);
+        }
+        g_free(data);
+    } else {
+        gtk_text_buffer_get_end_iter(buf, &end);
+        gtk_text_buffer_insert_with_tags_by_name(buf, &end, "(unable to read file)\n", -1, "comment", NULL);
+    }
+    gtk_text_buffer_get_end_iter(buf, &end);
+    gtk_text_buffer_insert(buf, &end, "\n", -1);
+}
+
+/* fill the unit-file pane with the unit's FragmentPath followed by all of its DropInPaths */
+static void show_unit_files(AppData *ad, const char *unit) {
+    if (!ad || !ad->unit_buffer) return;
+    GtkTextBuffer *buf = ad->unit_buffer;
+    gtk_text_buffer_set_text(buf, "", -1);
+    if (!unit) {
+        gtk_text_buffer_set_text(buf, "No service selected", -1);
+        return;
+    }
+
+    /* DropInPaths can be arbitrarily long, so don't read it into a fixed buffer */
+    gchar *fragment = get_unit_property_full(unit, "FragmentPath");
+    gchar *dropins = get_unit_property_full(unit, "DropInPaths");
+
+    if (fragment[0] != '\0') {
+        append_unit_file(buf, fragment);
+    } else {
+        GtkTextIter end;
+        gtk_text_buffer_get_end_iter(buf, &end);
+        gtk_text_buffer_insert_with_tags_by_name(buf, &end, "# no unit file on disk\n\n", -1, "comment", NULL);
+    }
+
+    gchar **paths = g_strsplit(dropins, " ", -1);
+    for (int i = 0; paths[i]; ++i) {
+        if (paths[i][0] != '\0') append_unit_file(buf, paths[i]);
+    }
+    g_strfreev(paths);
+    g_free(fragment);
+    g_free(dropins);
+}
+
+static void on_unit_selection_changed(GtkTreeSelection *sel, gpointer user_data) {
+    (void)sel;
+    AppData *ad = (AppData *)user_data;
+    gchar *unit = get_selected_unit(ad);
+    show_unit_files(ad, unit);
+    g_free(unit);
+}
+
+/* unit names may only contain letters, digits and : - _ . @ \; anything else would be unsafe in
+   a shell command. Backslash is needed for systemd's \x2d-style escapes; such an escape stays
+   literal inside the double quotes the override command puts around every path. */
+static gboolean unit_name_is_valid(const char *unit) {
+    if (!unit || unit[0] == '\0') return FALSE;
+    for (const char *p = unit; *p; ++p) {
+        if (!g_ascii_isalnum(*p) && !strchr(":-_.\\@", *p)) return FALSE;
+    }
+    return TRUE;
+}
+
+/* edit /etc/systemd/system/<unit>.d/override.conf; saving installs it through the
+   privileged action path and runs a single daemon-reload */
+static void on_edit_override_clicked(GtkButton *btn, gpointer user_data) {
+    AppData *ad = (AppData *)user_data;
+    gchar *unit = get_selected_unit(ad);
+    guint ctx = gtk_statusbar_get_context_id(ad->statusbar, "action");
+    if (!unit) {
+        gtk_statusbar_push(ad->statusbar, ctx, "No service selected");
+        return;
+    }
+    if (!unit_name_is_valid(unit)) {
+        gtk_statusbar_push(ad->statusbar, ctx, "Unsupported unit name");
+        g_free(unit);
+        return;
+    }
+
+    gchar *path = g_strdup_printf("/etc/systemd/system/%s.d/override.conf", unit);
+    gchar *current = read_unit_file(path, 0, NULL);
+
+    gchar *title = g_strdup_printf("Override: %s", unit);
+    GtkWidget *dlg = gtk_dialog_new_with_buttons(title,
+                                                 GTK_WINDOW(gtk_widget_get_toplevel(GTK_WIDGET(btn))),
+                                                 GTK_DIALOG_MODAL | GTK_DIALOG_DESTROY_WITH_PARENT,
+                                                 "_Save", GTK_RESPONSE_OK,
+                                                 "_Cancel", GTK_RESPONSE_CANCEL,
+                                                 NULL);
+    g_free(title);
+    gtk_window_set_default_size(GTK_WINDOW(dlg), 600, 400);
+    GtkWidget *content = gtk_dialog_get_content_area(GTK_DIALOG(dlg));
+
+    GtkWidget *lbl = gtk_label_new(path);
+    gtk_widget_set_halign(lbl, GTK_ALIGN_START);
+    gtk_widget_set_margin_start(lbl, 8);
+    gtk_box_pack_start(GTK_BOX(content), lbl, FALSE, FALSE, 4);
+
+    GtkWidget *tv = gtk_text_view_new();
+    gtk_text_view_set_monospace(GTK_TEXT_VIEW(tv), TRUE);
+    GtkTextBuffer *tb = gtk_text_view_get_buffer(GTK_TEXT_VIEW(tv));
+    gchar *current_utf8 = current ? g_utf8_make_valid(current, -1) : NULL;
+    gtk_text_buffer_set_text(tb, current_utf8 ? current_utf8 : "[Service]\n", -1);
+    g_free(current_utf8);
+    g_free(current);
+
+    GtkWidget *scrolled = gtk_scrolled_window_new(NULL, NULL);
+    gtk_container_add(GTK_CONTAINER(scrolled), tv);
+    gtk_scrolled_window_set_policy(GTK_SCROLLED_WINDOW(scrolled), GTK_POLICY_AUTOMATIC, GTK_POLICY_AUTOMATIC);
+    gtk_box_pack_start(GTK_BOX(content), scrolled, TRUE, TRUE, 0);
+
+    gtk_widget_show_all(dlg);
+    gint resp = gtk_dialog_run(GTK_DIALOG(dlg));
+    gchar *text = NULL;
+    if (resp == GTK_RESPONSE_OK) {
+        GtkTextIter s, e;
+        gtk_text_buffer_get_bounds(tb, &s, &e);
+        text = gtk_text_buffer_get_text(tb, &s, &e, FALSE);
+    }
+    gtk_widget_destroy(dlg);
+
+    if (text) {
+        /* stage the drop-in as the user, then let root install it */
+        gchar *tmp_path = NULL;
+        GError *gerr = NULL;
+        gint fd = g_file_open_tmp("sysd-mgr-override-XXXXXX.conf", &tmp_path, &gerr);
+        FILE *fp = (fd >= 0) ? fdopen(fd, "w") : NULL;
+        if (!fp) {
+            if (fd >= 0) close(fd);
+            gtk_statusbar_push(ad->statusbar, ctx, gerr ? gerr->message : "Unable to create temporary file");
+            g_clear_error(&gerr);
+        } else {
+            gboolean written = fputs(text, fp) >= 0;
+            written = (fclose(fp) == 0) && written;
+            if (written) {
+                gchar *cmd = g_strdup_printf("mkdir -p \"/etc/systemd/system/%s.d\" && "
+                                             "install -m 0644 \"%s\" \"%s\" && "
+                                             "systemctl daemon-reload",
+                                             unit, tmp_path, path);
+                run_systemctl_action_and_notify(ad, cmd);
+                g_free(cmd);
+                /* lists were repopulated (selection cleared); keep showing the edited unit */
+                show_unit_files(ad, unit);
+            } else {
+                gtk_statusbar_push(ad->statusbar, ctx, "Unable to write temporary file");
+            }
+        }
+        if (tmp_path) unlink(tmp_path);
+        g_free(tmp_path);
+        g_free(text);
+    }
+    g_free(path);
+    g_free(unit);
+}
+
+/* a broad search (e.g. "Exec") matches tens of thousands of lines; only show this many */
+#define UNIT_SEARCH_MAX_ROWS 2000
+
+/* state for the "Search Unit Files" window */
+typedef struct {
+    AppData *ad;
+    GtkWidget *entry;
+    GtkTreeView *tree;
+    GtkListStore *store;                   /* 3 cols: path, line, text; owned by tree */
+    GtkLabel *summary;
+} SearchWindow;
+
+/* search the (built) index for the entry text and fill the results view */
+static void show_unit_file_search(SearchWindow *sw) {
+    const gchar *needle = gtk_entry_get_text(GTK_ENTRY(sw->entry));
+    if (!needle || needle[0] == '\0') {
+        gtk_list_store_clear(sw->store);
+        gtk_label_set_text(sw->summary, "");
+        return;
+    }
+
+    UnitIndex *idx = sw->ad->unit_index;
+    GTimer *timer = g_timer_new();
+    guint files = 0;
+    /* fill a store that is not attached to the view yet, then swap it in, so the
+       tree view doesn't react to every inserted row */
+    GtkListStore *store = gtk_list_store_new(3, G_TYPE_STRING, G_TYPE_UINT, G_TYPE_STRING);
+    guint matches = unit_index_search(idx, needle, store, UNIT_SEARCH_MAX_ROWS, &files);
+    gtk_tree_view_set_model(sw->tree, GTK_TREE_MODEL(store));
+    g_object_unref(store);
+    sw->store = store;
+
+    gchar *shown = (matches > UNIT_SEARCH_MAX_ROWS)
+        ? g_strdup_printf(", showing first %u", UNIT_SEARCH_MAX_ROWS) : g_strdup("");
+    gchar *msg = g_strdup_printf("%u matching lines in %u files (%u indexed, %.0f ms%s)",
+                                 matches, files, g_hash_table_size(idx->files),
+                                 g_timer_elapsed(timer, NULL) * 1000.0, shown);
+    g_free(shown);
+    gtk_label_set_text(sw->summary, msg);
+    g_free(msg);
+    g_timer_destroy(timer);
+}
+
+static void on_unit_index_built(gpointer waiter, gpointer user_data) {
+    (void)user_data;
+    show_unit_file_search((SearchWindow *)waiter);
+}
+
+/* search right away if the index is current; otherwise (re)build it in the background
+   and search once it is done, keeping the UI responsive meanwhile */
+static void run_unit_file_search(SearchWindow *sw) {
+    const gchar *needle = gtk_entry_get_text(GTK_ENTRY(sw->entry));
+    if (!needle || needle[0] == '\0') {
+        gtk_list_store_clear(sw->store);
+        gtk_label_set_text(sw->summary, "");
+        return;
+    }
+
+    AppData *ad = sw->ad;
+    if (!ad->unit_index) ad->unit_index = unit_index_new(on_unit_index_built);
+    UnitIndex *idx = ad->unit_index;
+    if (idx->building || !idx->valid) {
+        gtk_list_store_clear(sw->store);
+        gtk_label_set_text(sw->summary, "indexing unit files...");
+        unit_index_add_waiter(idx, sw);
+        unit_index_build_start(idx);
+        return;
+    }
+    show_unit_file_search(sw);
+}
+
+static void on_search_window_destroy(GtkWidget *win, gpointer user_data) {
+    (void)win;
+    SearchWindow *sw = (SearchWindow *)user_data;
+    if (sw->ad->unit_index) {
+        sw->ad->unit_index->waiters = g_list_remove(sw->ad->unit_index->waiters, sw);
+    }
+    g_free(sw);
+}
+
+static void on_unit_search_activate(GtkWidget *w, gpointer user_data) {
+    (void)w;
+    run_unit_file_search((SearchWindow *)user_data);
+}
+
+static void on_search_unit_files(GtkMenuItem *item, gpointer user_data) {
+    (void)item;
+    AppData *ad = (AppData *)user_data;
+    SearchWindow *sw = g_new0(SearchWindow, 1);
+    sw->ad = ad;
+
+    GtkWidget *win = gtk_window_new(GTK_WINDOW_TOPLEVEL);
+    gtk_window_set_title(GTK_WINDOW(win), "Search Unit Files");
+    gtk_window_set_default_size(GTK_WINDOW(win), 900, 500);
+    gtk_window_set_transient_for(GTK_WINDOW(win), GTK_WINDOW(gtk_widget_get_toplevel(GTK_WIDGET(ad->statusbar))));
+    g_signal_connect(win, "destroy", G_CALLBACK(on_search_window_destroy), sw);
+
+    GtkWidget *vbox = gtk_box_new(GTK_ORIENTATION_VERTICAL, 6);
+    gtk_container_set_border_width(GTK_CONTAINER(vbox), 6);
+    gtk_container_add(GTK_CONTAINER(win), vbox);
+
+    GtkWidget *row = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 6);
+    sw->entry = gtk_entry_new();
+    gtk_entry_set_placeholder_text(GTK_ENTRY(sw->entry), "text to find in unit files and drop-ins, e.g. LimitNOFILE");
+    gtk_box_pack_start(GTK_BOX(row), sw->entry, TRUE, TRUE, 0);
+    GtkWidget *btn = gtk_button_new_with_label("Search");
+    gtk_box_pack_start(GTK_BOX(row), btn, FALSE, FALSE, 0);
+    gtk_box_pack_start(GTK_BOX(vbox), row, FALSE, FALSE, 0);
+    g_signal_connect(sw->entry, "activate", G_CALLBACK(on_unit_search_activate), sw);
+    g_signal_connect(btn, "clicked", G_CALLBACK(on_unit_search_activate), sw);
+
+    sw->store = gtk_list_store_new(3, G_TYPE_STRING, G_TYPE_UINT, G_TYPE_STRING);
+    GtkWidget *tree = gtk_tree_view_new_with_model(GTK_TREE_MODEL(sw->store));
+    g_object_unref(sw->store);
+    sw->tree = GTK_TREE_VIEW(tree);
+    GtkCellRenderer *r = gtk_cell_renderer_text_new();
+
+    GtkTreeViewColumn *c_path = gtk_tree_view_column_new_with_attributes("File", r, "text", 0, NULL);
+    gtk_tree_view_append_column(GTK_TREE_VIEW(tree), c_path);
+    gtk_tree_view_column_set_resizable(c_path, TRUE);
+
+    GtkTreeViewColumn *c_line = gtk_tree_view_column_new_with_attributes("Line", r, "text", 1, NULL);
+    gtk_tree_view_append_column(GTK_TREE_VIEW(tree), c_line);
+
+    GtkTreeViewColumn *c_text = gtk_tree_view_column_new_with_attributes("Text", r, "text", 2, NULL);
+    gtk_tree_view_append_column(GTK_TREE_VIEW(tree), c_text);
+    gtk_tree_view_column_set_expand(c_text, TRUE);
+
+    GtkWidget *scrolled = gtk_scrolled_window_new(NULL, NULL);
+    gtk_container_add(GTK_CONTAINER(scrolled), tree);
+    gtk_scrolled_window_set_policy(GTK_SCROLLED_WINDOW(scrolled), GTK_POLICY_AUTOMATIC, GTK_POLICY_AUTOMATIC);
+    gtk_box_pack_start(GTK_BOX(vbox), scrolled, TRUE, TRUE, 0);
+
+    GtkWidget *summary = gtk_label_new("");
+    gtk_widget_set_halign(summary, GTK_ALIGN_START);
+    sw->summary = GTK_LABEL(summary);
+    gtk_box_pack_start(GTK_BOX(vbox), summary, FALSE, FALSE, 0);
+
+    gtk_widget_show_all(win);
+    gtk_widget_grab_focus(sw->entry);
+}
+
 /* populate a GtkListStore (4 columns: name,state,pid,desc) by running `cmd`.
    mode: 0=list-units (parse units), 1=list-unit-files (parse unit-files) */
 static void on_switch_page(GtkNotebook *notebook, GtkWidget *page, guint page_num, gpointer user_data) {
@@ -499,11 +1204,13 @@ static void on_activate(GtkApplication *app, gpointer user_data) {
 
     GtkWidget *win = gtk_application_window_new(app);
     gtk_window_set_title(GTK_WINDOW(win), "SysD Manager");
-    gtk_window_set_default_size(GTK_WINDOW(win), 900, 550);
+    gtk_window_set_default_size(GTK_WINDOW(win), 900, 700);
 
     GtkWidget *vbox = gtk_box_new(GTK_ORIENTATION_VERTICAL, 0);
     gtk_container_add(GTK_CONTAINER(win), vbox);
 
+    AppData *ad = g_new0(AppData, 1);
+
     /* --- Menu bar --- */
     GtkWidget *menubar = gtk_menu_bar_new();
 
@@ -516,6 +1223,15 @@ static void on_activate(GtkApplication *app, gpointer user_data) {
     gtk_menu_item_set_submenu(GTK_MENU_ITEM(file_item), file_menu);
     gtk_menu_shell_append(GTK_MENU_SHELL(menubar), file_item);
 
+    /* Tools menu */
+    GtkWidget *tools_item = gtk_menu_item_new_with_label("Tools");
+    GtkWidget *tools_menu = gtk_menu_new();
+    GtkWidget *search_item = gtk_menu_item_new_with_label("Search Unit Files...");
+    g_signal_connect(search_item, "activate", G_CALLBACK(on_search_unit_files), ad);
+    gtk_menu_shell_append(GTK_MENU_SHELL(tools_menu), search_item);
+    gtk_menu_item_set_submenu(GTK_MENU_ITEM(tools_item), tools_menu);
+    gtk_menu_shell_append(GTK_MENU_SHELL(menubar), tools_item);
+
     /* Help menu */
     GtkWidget *help_item = gtk_menu_item_new_with_label("Help");
     GtkWidget *help_menu = gtk_menu_new();
@@ -528,7 +1244,6 @@ static void on_activate(GtkApplication *app, gpointer user_data) {
     gtk_box_pack_start(GTK_BOX(vbox), menubar, FALSE, FALSE, 0);
 
     /* --- Filter row (new) --- */
-    AppData *ad = g_new0(AppData, 1);
     GtkWidget *filter_box = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 6);
     gtk_widget_set_margin_top(filter_box, 6);
     gtk_widget_set_margin_bottom(filter_box, 6);
@@ -548,6 +1263,7 @@ static void on_activate(GtkApplication *app, gpointer user_data) {
 
     /* --- Notebook with three tabs --- */
     GtkWidget *notebook = gtk_notebook_new();
+    ad->notebook = GTK_NOTEBOOK(notebook);
 
     /* create views: pass AppData and index so filter can reference entry */
     GtkWidget *sc1 = create_service_list_view(ad, 0, &ad->stores[0]);
@@ -559,7 +1275,45 @@ static void on_activate(GtkApplication *app, gpointer user_data) {
     GtkWidget *sc3 = create_service_list_view(ad, 2, &ad->stores[2]);
     gtk_notebook_append_page(GTK_NOTEBOOK(notebook), sc3, gtk_label_new("All Services"));
 
-    gtk_box_pack_start(GTK_BOX(vbox), notebook, TRUE, TRUE, 0);
+    for (int i = 0; i < 3; ++i) {
+        g_signal_connect(gtk_tree_view_get_selection(ad->views[i]), "changed",
+                         G_CALLBACK(on_unit_selection_changed), ad);
+    }
+
+    /* --- Unit file pane: notebook above, selected unit's file + drop-ins below --- */
+    GtkWidget *paned = gtk_paned_new(GTK_ORIENTATION_VERTICAL);
+    gtk_paned_pack1(GTK_PANED(paned), notebook, TRUE, FALSE);
+
+    GtkWidget *unit_box = gtk_box_new(GTK_ORIENTATION_VERTICAL, 4);
+    gtk_widget_set_margin_start(unit_box, 6);
+    gtk_widget_set_margin_end(unit_box, 6);
+
+    GtkWidget *unit_view = gtk_text_view_new();
+    gtk_text_view_set_editable(GTK_TEXT_VIEW(unit_view), FALSE);
+    gtk_text_view_set_monospace(GTK_TEXT_VIEW(unit_view), TRUE);
+    ad->unit_buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(unit_view));
+    gtk_text_buffer_create_tag(ad->unit_buffer, "header", "weight", PANGO_WEIGHT_BOLD,
+                               "paragraph-background", "#e8e8e8", NULL);
+    gtk_text_buffer_create_tag(ad->unit_buffer, "section", "weight", PANGO_WEIGHT_BOLD,
+                               "foreground", "#1f5fa8", NULL);
+    gtk_text_buffer_create_tag(ad->unit_buffer, "key", "foreground", "#8a4b08", NULL);
+    gtk_text_buffer_create_tag(ad->unit_buffer, "comment", "foreground", "#808080",
+                               "style", PANGO_STYLE_ITALIC, NULL);
+    gtk_text_buffer_set_text(ad->unit_buffer, "No service selected", -1);
+
+    GtkWidget *unit_scrolled = gtk_scrolled_window_new(NULL, NULL);
+    gtk_container_add(GTK_CONTAINER(unit_scrolled), unit_view);
+    gtk_scrolled_window_set_policy(GTK_SCROLLED_WINDOW(unit_scrolled), GTK_POLICY_AUTOMATIC, GTK_POLICY_AUTOMATIC);
+    gtk_box_pack_start(GTK_BOX(unit_box), unit_scrolled, TRUE, TRUE, 0);
+
+    GtkWidget *btn_override = gtk_button_new_with_label("Edit Override...");
+    gtk_widget_set_halign(btn_override, GTK_ALIGN_START);
+    g_signal_connect(btn_override, "clicked", G_CALLBACK(on_edit_override_clicked), ad);
+    gtk_box_pack_start(GTK_BOX(unit_box), btn_override, FALSE, FALSE, 0);
+
+    gtk_paned_pack2(GTK_PANED(paned), unit_box, FALSE, TRUE);
+    gtk_paned_set_position(GTK_PANED(paned), 330);
+    gtk_box_pack_start(GTK_BOX(vbox), paned, TRUE, TRUE, 0);
 
     /* --- Control bar --- */
     GtkWidget *ctrl_box = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 6);